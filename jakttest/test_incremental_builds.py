@@ -0,0 +1,282 @@
+# SPDX-License-Identifier: BSD-2-Clause
+
+# Builds small programs with jakt, edits one of their inputs, builds them again and checks that
+# the rebuilt binary reflects the edit (and that nothing is rebuilt when nothing changed).
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+
+class Project:
+    def __init__(self, directory, args):
+        self.directory = directory
+        self.args = args
+        self.binary_dir = directory / "build"
+        self.runtime_path = args.runtime_path
+
+    def write(self, name, contents):
+        path = self.directory / name
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text(contents)
+
+    def build(self, *extra_args):
+        result = subprocess.run(
+            [
+                self.args.jakt_binary,
+                "-C", self.args.cpp_compiler,
+                "-R", self.runtime_path,
+                "--runtime-library-path", self.args.jakt_lib_dir,
+                "-B", self.binary_dir,
+                "-I", self.directory,
+                *extra_args,
+                "main.jakt",
+            ],
+            cwd=self.directory,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            text=True,
+        )
+        if result.returncode != 0:
+            raise AssertionError(f"build failed:\n{result.stdout}{result.stderr}")
+
+    # Builds against a copy of the runtime headers, so that the test can edit them.
+    def copy_runtime(self):
+        runtime = self.directory / "runtime"
+        shutil.copytree(self.args.runtime_path, runtime)
+        self.runtime_path = str(runtime)
+        return runtime
+
+    def run(self):
+        return subprocess.run(
+            [self.binary_dir / "main"], check=True, stdout=subprocess.PIPE, text=True
+        ).stdout
+
+    def modification_time(self, name):
+        return os.stat(self.binary_dir / name).st_mtime_ns
+
+
+def expect_equal(actual, expected, what):
+    if actual != expected:
+        raise AssertionError(f"{what}: expected {expected!r}, got {actual!r}")
+
+
+EXTERN_HEADER_PROGRAM = """
+import extern "val.h" {
+    extern function magic_value() -> i32
+}
+
+function main() {
+    println("{}", magic_value())
+}
+"""
+
+
+def test_extern_header_edit_rebuilds_object(project):
+    project.write("main.jakt", EXTERN_HEADER_PROGRAM)
+    project.write("val.h", "inline int magic_value() { return 1; }\n")
+    project.build()
+    expect_equal(project.run(), "1\n", "first build")
+
+    project.write("val.h", "inline int magic_value() { return 2; }\n")
+    project.build()
+    expect_equal(project.run(), "2\n", "rebuild after editing val.h")
+
+    project.write("val.h", "inline int magic_value() { return 3; }\n")
+    project.build("--no-module-cache")
+    expect_equal(project.run(), "3\n", "rebuild after editing val.h without the module cache")
+
+
+def test_unchanged_build_reuses_objects(project):
+    project.write("main.jakt", EXTERN_HEADER_PROGRAM)
+    project.write("val.h", "inline int magic_value() { return 1; }\n")
+    project.build()
+    built = project.modification_time("main.o")
+
+    project.build()
+    expect_equal(project.modification_time("main.o"), built, "main.o after an unchanged build")
+
+    project.build("--no-object-cache")
+    if project.modification_time("main.o") == built:
+        raise AssertionError("main.o was not rebuilt with --no-object-cache")
+    expect_equal(project.run(), "1\n", "rebuild with --no-object-cache")
+
+
+def test_runtime_header_edit_rebuilds_precompiled_header(project):
+    lib_header = project.copy_runtime() / "lib.h"
+    runtime_contents = lib_header.read_text()
+    project.write("main.jakt", EXTERN_HEADER_PROGRAM)
+    project.write("val.h", "inline int magic_value() { return JAKT_TEST_MAGIC_VALUE; }\n")
+
+    lib_header.write_text(runtime_contents + "#define JAKT_TEST_MAGIC_VALUE 1\n")
+    project.build("--pch")
+    expect_equal(project.run(), "1\n", "first build")
+
+    lib_header.write_text(runtime_contents + "#define JAKT_TEST_MAGIC_VALUE 2\n")
+    project.build("--pch")
+    expect_equal(project.run(), "2\n", "rebuild after editing lib.h")
+
+
+IMPORTING_PROGRAM = """
+import helper { helper_value }
+
+function main() {
+    println("{} {}", helper_value(), MAIN_VALUE)
+}
+"""
+
+
+def test_module_cache_reused_when_unchanged(project):
+    project.write("main.jakt", IMPORTING_PROGRAM.replace("MAIN_VALUE", "1"))
+    project.write("helper.jakt", "function helper_value() -> i64 => 1\n")
+    project.build()
+    cached = project.modification_time(".jakt-module-cache")
+
+    # A build that reuses the cache doesn't record it again.
+    project.build()
+    expect_equal(project.modification_time(".jakt-module-cache"), cached, "module cache after an unchanged build")
+    expect_equal(project.run(), "1 1\n", "unchanged build")
+
+
+def test_source_edit_invalidates_module_cache(project):
+    project.write("main.jakt", IMPORTING_PROGRAM.replace("MAIN_VALUE", "1"))
+    project.write("helper.jakt", "function helper_value() -> i64 => 1\n")
+    project.build()
+    expect_equal(project.run(), "1 1\n", "first build")
+
+    project.write("main.jakt", IMPORTING_PROGRAM.replace("MAIN_VALUE", "2"))
+    project.build()
+    expect_equal(project.run(), "1 2\n", "rebuild after editing main.jakt")
+
+
+def test_imported_module_edit_invalidates_module_cache(project):
+    project.write("main.jakt", IMPORTING_PROGRAM.replace("MAIN_VALUE", "1"))
+    project.write("helper.jakt", "function helper_value() -> i64 => 1\n")
+    project.build()
+    expect_equal(project.run(), "1 1\n", "first build")
+
+    project.write("helper.jakt", "function helper_value() -> i64 => 2\n")
+    project.build()
+    expect_equal(project.run(), "2 1\n", "rebuild after editing helper.jakt")
+
+
+def test_extern_header_edit_invalidates_module_cache(project):
+    project.write("main.jakt", EXTERN_HEADER_PROGRAM)
+    project.write("val.h", "inline int magic_value() { return 1; }\n")
+    project.build()
+    cached = project.modification_time(".jakt-module-cache")
+
+    project.write("val.h", "inline int magic_value() { return 2; }\n")
+    project.build()
+    if project.modification_time(".jakt-module-cache") == cached:
+        raise AssertionError("the module cache was reused after editing val.h")
+    expect_equal(project.run(), "2\n", "rebuild after editing val.h")
+
+
+def test_unity_build_rebuilds_after_module_edit(project):
+    project.write("main.jakt", IMPORTING_PROGRAM.replace("MAIN_VALUE", "1"))
+    project.write("helper.jakt", "function helper_value() -> i64 => 1\n")
+    project.build("--unity", "2")
+    expect_equal(project.run(), "1 1\n", "first build")
+    unity_objects = sorted(path.name for path in project.binary_dir.glob("jakt-unity-*.o"))
+    expect_equal(unity_objects, ["jakt-unity-0.o", "jakt-unity-1.o"], "unity objects")
+    built = {name: project.modification_time(name) for name in unity_objects}
+
+    project.build("--unity", "2")
+    expect_equal({name: project.modification_time(name) for name in unity_objects}, built, "unity objects after an unchanged build")
+
+    project.write("helper.jakt", "function helper_value() -> i64 => 2\n")
+    project.build("--unity", "2")
+    expect_equal(project.run(), "2 1\n", "rebuild after editing helper.jakt")
+
+
+def test_parallel_code_generation_matches_serial(project):
+    project.write("main.jakt", IMPORTING_PROGRAM.replace("MAIN_VALUE", "1"))
+    project.write("helper.jakt", "function helper_value() -> i64 => 1\n")
+
+    def generated_sources():
+        return {
+            path.name: path.read_text()
+            for path in project.binary_dir.iterdir()
+            if path.suffix in (".cpp", ".h")
+        }
+
+    project.build("-S")
+    serial = generated_sources()
+    shutil.rmtree(project.binary_dir)
+
+    project.build("-S", "--codegen-jobs", "4")
+    expect_equal(generated_sources(), serial, "sources generated in parallel")
+
+    project.build("--codegen-jobs", "4")
+    expect_equal(project.run(), "1 1\n", "first build")
+
+    project.write("helper.jakt", "function helper_value() -> i64 => 2\n")
+    project.build("--codegen-jobs", "4")
+    expect_equal(project.run(), "2 1\n", "rebuild after editing helper.jakt")
+
+
+TESTS = [
+    test_extern_header_edit_rebuilds_object,
+    test_unchanged_build_reuses_objects,
+    test_runtime_header_edit_rebuilds_precompiled_header,
+    test_module_cache_reused_when_unchanged,
+    test_source_edit_invalidates_module_cache,
+    test_imported_module_edit_invalidates_module_cache,
+    test_extern_header_edit_invalidates_module_cache,
+    test_unity_build_rebuilds_after_module_edit,
+    test_parallel_code_generation_matches_serial,
+]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Test rebuilds after editing a program's inputs")
+    parser.add_argument(
+        "--jakt-binary", help="The path to the jakt binary", default="build/bin/jakt"
+    )
+    parser.add_argument(
+        "--jakt-lib-dir",
+        help="The path to the jakt library directory",
+        default="build/lib",
+    )
+    parser.add_argument(
+        "--runtime-path",
+        help="The path to the jakt runtime headers",
+        default="build/include/runtime",
+    )
+    parser.add_argument(
+        "--cpp-compiler",
+        help="Path to the C++ compiler to use (defaults to clang++ on $PATH)",
+        default="clang++"
+    )
+    args = parser.parse_args()
+
+    args.jakt_binary = str(Path(args.jakt_binary).resolve())
+    args.jakt_lib_dir = str(Path(args.jakt_lib_dir).resolve())
+    args.runtime_path = str(Path(args.runtime_path).resolve())
+    # Only resolve paths, a compiler found on $PATH is left to be found there.
+    if os.sep in args.cpp_compiler:
+        args.cpp_compiler = str(Path(args.cpp_compiler).resolve())
+
+    failed = 0
+    for test in TESTS:
+        directory = Path(tempfile.mkdtemp(prefix="jakt-incremental-"))
+        try:
+            test(Project(directory, args))
+            print(f"PASS {test.__name__}")
+        except AssertionError as e:
+            failed += 1
+            print(f"FAIL {test.__name__}: {e}")
+        finally:
+            shutil.rmtree(directory, ignore_errors=True)
+
+    print(f"{len(TESTS) - failed} passed, {failed} failed")
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
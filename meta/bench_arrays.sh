@@ -0,0 +1,62 @@
+#!/bin/bash
+
+# Times building and running array-heavy loops that index arrays with the variable of a `for i in 0..xs.size()` loop,
+# with each given compiler, e.g. to compare one that skips the bounds checks of such indexing against one that does not.
+# Usage: meta/bench_arrays.sh [COMPILER...]
+
+set -e
+
+: "${JAKT_RUNTIME_DIR:=Build/lib}"
+: "${CXX_COMPILER:=clang++}"
+
+COMPILERS="${*:-${CURRENT_JAKT_COMPILER:-Build/bin/jakt}}"
+BENCH_DIR="$(mktemp -d)"
+
+trap 'rm -fr "$BENCH_DIR"' EXIT
+
+cat > "$BENCH_DIR/arrays.jakt" <<'EOF_JAKT'
+function dot(anon a: [i64], anon b: [i64]) -> i64 {
+    mut total = 0
+    for i in 0..a.size() {
+        total += a[i] * b[i]
+    }
+    return total
+}
+
+function main() {
+    mut values: [i64] = []
+    for i in 0..4096 {
+        values.push((i * 7919) % 1000)
+    }
+
+    mut checksum = 0
+    for round in 0..40000 {
+        mut prefix = 0
+        for i in 0..values.size() {
+            prefix += values[i]
+            values[i] = (values[i] + round) % 1000
+        }
+        checksum += prefix % 1000 + dot(values, values) % 1000
+    }
+    println("{}", checksum)
+}
+EOF_JAKT
+
+printf "%-40s %-14s %s\n" "compiler" "build seconds" "run seconds"
+for compiler in $COMPILERS; do
+    rm -fr "$BENCH_DIR/build"
+    start=$(date +%s.%N)
+    "$compiler" \
+        --no-module-cache \
+        -O \
+        --binary-dir "$BENCH_DIR/build" \
+        --cxx-compiler-path "$CXX_COMPILER" \
+        --runtime-library-path "$JAKT_RUNTIME_DIR" \
+        --runtime-path runtime \
+        --output-filename arrays \
+        "$BENCH_DIR/arrays.jakt" > /dev/null 2>&1
+    built=$(date +%s.%N)
+    "$BENCH_DIR/build/arrays" > /dev/null
+    end=$(date +%s.%N)
+    printf "%-40s %-14.1f %.2f\n" "$compiler" "$(awk "BEGIN { print $built - $start }")" "$(awk "BEGIN { print $end - $built }")"
+done
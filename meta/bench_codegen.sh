@@ -0,0 +1,49 @@
+#!/bin/bash
+
+# Reports the bytes of C++ emitted for the selfhosted compiler and the heap allocations made while generating it.
+# Allocations are counted by interposing malloc; the codegen phase's share is the difference between a run that
+# stops after typechecking (-c) and one that also generates and writes the sources (-S).
+
+set -e
+
+: "${CURRENT_JAKT_COMPILER:=Build/bin/jakt}"
+: "${CC:=cc}"
+
+BENCH_DIR="$(mktemp -d)"
+trap 'rm -fr "$BENCH_DIR"' EXIT
+
+cat > "$BENCH_DIR/count_allocations.c" <<'EOF'
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+
+extern void* __libc_malloc(size_t);
+extern void* __libc_calloc(size_t, size_t);
+extern void* __libc_realloc(void*, size_t);
+
+static unsigned long long allocations;
+static unsigned long long allocated_bytes;
+
+void* malloc(size_t size) { allocations++; allocated_bytes += size; return __libc_malloc(size); }
+void* calloc(size_t count, size_t size) { allocations++; allocated_bytes += count * size; return __libc_calloc(count, size); }
+void* realloc(void* pointer, size_t size) { allocations++; allocated_bytes += size; return __libc_realloc(pointer, size); }
+
+__attribute__((destructor)) static void report(void)
+{
+    fprintf(stderr, "allocations %llu %llu\n", allocations, allocated_bytes);
+}
+EOF
+"$CC" -shared -fPIC -O2 -o "$BENCH_DIR/count_allocations.so" "$BENCH_DIR/count_allocations.c"
+
+count_allocations() {
+    LD_PRELOAD="$BENCH_DIR/count_allocations.so" "$CURRENT_JAKT_COMPILER" --no-module-cache --binary-dir "$BENCH_DIR/build" \
+        --runtime-path runtime "$@" selfhost/main.jakt 2>&1 >/dev/null | awk '/^allocations / { print $2, $3 }' | tail -n 1
+}
+
+read -r check_count check_bytes <<< "$(count_allocations -c)"
+read -r emit_count emit_bytes <<< "$(count_allocations -S)"
+emitted_bytes=$(cat "$BENCH_DIR"/build/*.h "$BENCH_DIR"/build/*.cpp | wc -c)
+
+echo "bytes emitted:          $emitted_bytes"
+echo "codegen allocations:    $((emit_count - check_count))"
+echo "codegen bytes allocated: $((emit_bytes - check_bytes))"
@@ -0,0 +1,68 @@
+#!/bin/bash
+
+# Times running an integer-heavy script through the interpreter (`jakt -r`, which is also what evaluates
+# comptime functions) with each given compiler, e.g. to compare interpreter changes.
+# Usage: meta/bench_comptime.sh [COMPILER...]
+
+set -e
+
+COMPILERS="${*:-${CURRENT_JAKT_COMPILER:-Build/bin/jakt}}"
+BENCH_DIR="$(mktemp -d)"
+
+trap 'rm -fr "$BENCH_DIR"' EXIT
+
+cat > "$BENCH_DIR/interpret.jakt" <<'EOF'
+function is_prime(anon value: u64) -> bool {
+    if value < 2 {
+        return false
+    }
+    mut divisor = 2u64
+    while divisor * divisor <= value {
+        if value / divisor * divisor == value {
+            return false
+        }
+        divisor++
+    }
+    return true
+}
+
+function collatz_steps(anon start: u64) -> u64 {
+    mut value = start
+    mut steps = 0u64
+    while value != 1 {
+        if (value & 1) == 0 {
+            value >>= 1
+        } else {
+            value = value * 3 + 1
+        }
+        steps++
+    }
+    return steps
+}
+
+function main() {
+    mut primes = 0
+    for i in 0u64..20000u64 {
+        if is_prime(i) {
+            primes++
+        }
+    }
+    mut longest = 0u64
+    for start in 1u64..3000u64 {
+        let steps = collatz_steps(start)
+        if steps > longest {
+            longest = steps
+        }
+    }
+    println("{} primes", primes)
+    println("longest chain {}", longest)
+}
+EOF
+
+printf "%-40s %s\n" "compiler" "run seconds"
+for compiler in $COMPILERS; do
+    start=$(date +%s.%N)
+    "$compiler" --runtime-path runtime -r "$BENCH_DIR/interpret.jakt" > /dev/null
+    end=$(date +%s.%N)
+    printf "%-40s %.2f\n" "$compiler" "$(awk "BEGIN { print $end - $start }")"
+done
@@ -0,0 +1,85 @@
+#!/bin/bash
+
+# Times building and running a lexer-style byte dispatch loop, which matches on byte constants, with each given
+# compiler, e.g. to compare one that generates a switch for such matches against one that does not.
+# Usage: meta/bench_match.sh [COMPILER...]
+
+set -e
+
+: "${JAKT_RUNTIME_DIR:=Build/lib}"
+: "${CXX_COMPILER:=clang++}"
+
+COMPILERS="${*:-${CURRENT_JAKT_COMPILER:-Build/bin/jakt}}"
+BENCH_DIR="$(mktemp -d)"
+
+trap 'rm -fr "$BENCH_DIR"' EXIT
+
+cat > "$BENCH_DIR/dispatch.jakt" <<'EOF'
+enum TokenClass {
+    Whitespace
+    Bracket
+    Operator
+    Digit
+    Quote
+    Punctuation
+    Identifier
+}
+
+function classify(anon byte: u8) -> TokenClass => match byte {
+    b' ' | b'\t' | b'\n' => TokenClass::Whitespace
+    b'(' | b')' | b'[' | b']' | b'{' | b'}' => TokenClass::Bracket
+    b'+' | b'-' | b'*' | b'/' | b'%' | b'=' | b'<' | b'>' | b'!' => TokenClass::Operator
+    b'0' | b'1' | b'2' | b'3' | b'4' | b'5' | b'6' | b'7' | b'8' | b'9' => TokenClass::Digit
+    b'"' | b'\'' => TokenClass::Quote
+    b',' | b'.' | b':' | b';' => TokenClass::Punctuation
+    else => TokenClass::Identifier
+}
+
+function main() {
+    let source = "function main() {\n    let x = (a + 42) * b[3] % 7;\n    println(\"{}\", x != 0)\n}\n"
+    mut tokens = 0
+    mut weight = 0
+    for round in 0..200000 {
+        mut previous = TokenClass::Whitespace
+        for i in 0..source.length() {
+            let token_class = classify(source.byte_at(i))
+            let starts_token = match token_class {
+                Whitespace => false
+                Identifier | Digit => not (previous is Identifier or previous is Digit)
+                else => true
+            }
+            previous = token_class
+            if not starts_token {
+                continue
+            }
+            tokens++
+            weight += match token_class {
+                Bracket => 1
+                Operator => 2
+                Quote | Punctuation => 3
+                else => 4
+            }
+        }
+    }
+    println("{} tokens, weight {}", tokens, weight)
+}
+EOF
+
+printf "%-40s %-14s %s\n" "compiler" "build seconds" "run seconds"
+for compiler in $COMPILERS; do
+    rm -fr "$BENCH_DIR/build"
+    start=$(date +%s.%N)
+    "$compiler" \
+        --no-module-cache \
+        -O \
+        --binary-dir "$BENCH_DIR/build" \
+        --cxx-compiler-path "$CXX_COMPILER" \
+        --runtime-library-path "$JAKT_RUNTIME_DIR" \
+        --runtime-path runtime \
+        --output-filename dispatch \
+        "$BENCH_DIR/dispatch.jakt" > /dev/null 2>&1
+    built=$(date +%s.%N)
+    "$BENCH_DIR/build/dispatch" > /dev/null
+    end=$(date +%s.%N)
+    printf "%-40s %-14.1f %.2f\n" "$compiler" "$(awk "BEGIN { print $built - $start }")" "$(awk "BEGIN { print $end - $built }")"
+done
@@ -0,0 +1,35 @@
+#!/bin/bash
+
+# Times a clean build of the selfhosted compiler for each combination of --unity and --jobs.
+# Usage: meta/bench_unity.sh [UNITY_COUNTS] [JOB_COUNTS], e.g. meta/bench_unity.sh "0 1 4" "1 2"
+
+set -e
+
+: "${CURRENT_JAKT_COMPILER:=Build/bin/jakt}"
+: "${JAKT_RUNTIME_DIR:=Build/lib}"
+: "${CXX_COMPILER:=clang++}"
+
+UNITY_COUNTS="${1:-0 1 2 4 8}"
+JOB_COUNTS="${2:-1 2 4}"
+BENCH_DIR="$(mktemp -d)"
+
+trap 'rm -fr "$BENCH_DIR"' EXIT
+
+printf "%-8s %-6s %s\n" "unity" "jobs" "seconds"
+for unity in $UNITY_COUNTS; do
+    for jobs in $JOB_COUNTS; do
+        rm -fr "$BENCH_DIR/build"
+        start=$(date +%s.%N)
+        "$CURRENT_JAKT_COMPILER" \
+            --no-module-cache \
+            --unity "$unity" \
+            --jobs "$jobs" \
+            --binary-dir "$BENCH_DIR/build" \
+            --cxx-compiler-path "$CXX_COMPILER" \
+            --runtime-library-path "$JAKT_RUNTIME_DIR" \
+            --runtime-path runtime \
+            selfhost/main.jakt > /dev/null 2>&1
+        end=$(date +%s.%N)
+        printf "%-8s %-6s %.1f\n" "$unity" "$jobs" "$(awk "BEGIN { print $end - $start }")"
+    done
+done
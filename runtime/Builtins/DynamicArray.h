@@ -131,6 +131,10 @@ public:
         return m_elements[index];
     }
 
+    // For callers that have already checked the index against size().
+    T const& unchecked_at(size_t index) const { return m_elements[index]; }
+    T& unchecked_at(size_t index) { return m_elements[index]; }
+
     ErrorOr<void> push(T value)
     {
         TRY(add_capacity(1));
@@ -271,6 +275,9 @@ public:
         return m_storage->at(index);
     }
 
+    T const& unchecked_at(size_t index) const { return m_storage->unchecked_at(index); }
+    T& unchecked_at(size_t index) { return m_storage->unchecked_at(index); }
+
     bool contains(T const& value) const
     {
         return m_storage->contains(value);
@@ -87,6 +87,9 @@ ErrorOr<DynamicArray<u8>> File::read_all()
             return Error::from_errno(error);
         }
         size_t old_size = entire_file.size();
+        // Grow geometrically, add_size() alone would reallocate and copy the whole buffer on every chunk.
+        if (old_size + nread > entire_file.capacity())
+            TRY(entire_file.ensure_capacity(max(old_size * 2, old_size + nread)));
         TRY(entire_file.add_size(nread));
         memcpy(entire_file.unsafe_data() + old_size, buffer, nread);
     }